@@ -0,0 +1,68 @@
+#!/bin/bash
+###############################################################################
+# makeSpotLibrary.sh - build a library of spot responses for spotQuery.       #
+#                                                                             #
+# makeSpotLibrary.sh <dir> "<sT values>" "<sP values>" "<sF1> <sF2>"          #
+#   [runDGCPM options]                                                        #
+#                                                                             #
+# Runs runDGCPM -response for a spot at every combination of the listed       #
+# co-latitudes and local times (in degrees), each at the two amplification    #
+# factors sF1 and sF2, and writes the response files and the index file       #
+# <dir>/index for spotQuery -l. spotQuery interpolates affinely in sF         #
+# between the two runs, so choose sF1 and sF2 to bracket the factors to be    #
+# queried. The remaining options are passed to runDGCPM and must include -f   #
+# and the Kp files. Use the same sR, sStart and sStop for the library as for  #
+# the queries. Set RUNDGCPM to use a runDGCPM other than the one in src/.     #
+# Runs are independent, set JOBS to run that many at once. If any run fails   #
+# the failed runs are listed, no index is written and the exit status is 1.   #
+###############################################################################
+
+if [ $# -lt 4 ]; then
+    echo "makeSpotLibrary.sh <dir> \"<sT values>\" \"<sP values>\"" \
+	"\"<sF1> <sF2>\" [runDGCPM options]"
+    exit 1
+fi
+
+dir=$1
+sTs=$2
+sPs=$3
+sFs=$4
+shift 4
+
+if [ $(echo $sFs | wc -w) -ne 2 ]; then
+    echo "Give exactly two amplification factors"
+    exit 1
+fi
+
+RUNDGCPM=${RUNDGCPM:-$(dirname $0)/../src/runDGCPM}
+JOBS=${JOBS:-1}
+
+mkdir -p $dir
+rm -f $dir/index $dir/failed
+
+files=
+for sT in $sTs; do
+    for sP in $sPs; do
+	for sF in $sFs; do
+	    f=response_${sT}_${sP}_${sF}
+	    files="$files $f.dat"
+	    ( $RUNDGCPM "$@" -sT $sT -sP $sP -sF $sF -response \
+		-o $dir/$f.dat > $dir/$f.log || echo $f >> $dir/failed ) &
+	    while [ $(jobs -r | wc -l) -ge $JOBS ]; do
+		wait -n
+	    done
+	done
+    done
+done
+wait
+
+if [ -e $dir/failed ]; then
+    for f in $(cat $dir/failed); do
+	echo "runDGCPM failed for $f, see $dir/$f.log"
+    done
+    exit 1
+fi
+
+for f in $files; do
+    echo $f >> $dir/index
+done